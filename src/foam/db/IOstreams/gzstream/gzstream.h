@@ -55,8 +55,9 @@ private:
 
    //------------------------------------
 
-   static const int bufferSize = 47+256;
-   // totals 512 bytes under g++ for igzstream at the end.
+   // Large enough for gzread/gzwrite to work on whole deflate blocks.
+   // Reads of binary blocks larger than the buffer bypass it, see xsgetn
+   static const int bufferSize = 4+65536;
 
    //------------------------------------
    gzFile           file;
@@ -97,6 +98,7 @@ public:
    gzstreambuf* close();
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
+   virtual std::streamsize xsgetn( char* s, std::streamsize n);
    virtual int     sync();
 };
 